@@ -0,0 +1,1292 @@
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    IVBENCH measures the speed of the IVCON readers, writers and passes.
+//
+//  Discussion:
+//
+//    IVBENCH makes synthetic meshes, writes each of them in every format,
+//    and then times every reader against every writer, and the passes
+//    that clean up the data after it is read.  It is run as
+//
+//      ivbench [options]
+//
+//    with the options
+//
+//      -sizes 1000,10000,100000   the numbers of triangles;
+//      -shapes sphere,grid,scan   the meshes;
+//      -formats obj,stlb,...      the formats, or "all", the default;
+//      -dir ivbench_data          the directory for the mesh files;
+//      -csv file                  write the results as CSV;
+//      -json file                 write the results as JSON.
+//
+//    A SPHERE is a globe of latitude and longitude bands, a GRID is a
+//    square height field, and a SCAN is a sphere whose nodes have been
+//    moved by random noise, as in a scanned part.  The sizes run up to
+//    a few million triangles; a full survey would be
+//
+//      ivbench -sizes 1000,10000,100000,1000000,5000000
+//
+//    although some formats, such as 3DS, cannot hold the larger meshes.
+//
+//    Each measurement runs in its own process, so that the peak resident
+//    memory reported is that of the one conversion.  There are three
+//    kinds of result:
+//
+//      stage "read" and the stages of DATA_READ, for each reader;
+//      the passes, EDGE_COUNT, FACE_NULL_DELETE and so on, each run once
+//      more on the data as read;
+//      stage "write" and "convert", reading and then writing, for each
+//      reader and writer pair.
+//
+//    Each result gives the time, the MB/s where there is a file to
+//    measure, the triangles per second, and the peak memory.  The readers
+//    and writers are called directly, so a conversion that IVCON would
+//    stream, such as STL to STL, is timed the ordinary way.
+//
+//    IVBENCH is compiled together with IVCON.CPP, which it includes, so
+//    that it can call the passes directly.  It needs FORK, and does not
+//    run under Windows.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license.
+//
+//  Modified:
+//
+//    17 October 2026
+//
+# define IVCON_LIBRARY
+# include "../ivcon.cpp"
+
+# include <cerrno>
+
+# define BENCH_FORMAT_MAX 32
+# define BENCH_PASS_NUM 7
+# define BENCH_SIZE_MAX 32
+//
+//  The times sent back by a worker are, in order: the stages of DATA_READ,
+//  the write, and the passes.
+//
+# define BENCH_TIME_NUM ( STAGE_NUM + 1 + BENCH_PASS_NUM )
+
+struct BenchResult
+{
+  bool ok;
+  double seconds[BENCH_TIME_NUM];
+};
+
+struct BenchRow
+{
+  char shape[8];
+  int triangles;
+  char reader[8];
+  char writer[8];
+  char stage[32];
+  bool ok;
+  long int bytes;
+  double seconds;
+  long int rss_kb;
+};
+
+int main ( int argc, char *argv[] );
+void bench_generate ( char *shape, int triangles );
+int bench_grid ( int triangles );
+int bench_list ( char *list, char item[][8], int item_max );
+void bench_report_csv ( FILE *file );
+void bench_report_json ( FILE *file );
+void bench_row ( char *shape, int triangles, char *reader, char *writer,
+  const char *stage, bool ok, long int bytes, double seconds,
+  long int rss_kb );
+bool bench_run ( char *in_name, char *out_name, BenchResult *result,
+  long int *rss_kb );
+long int bench_size ( char *file_name );
+int bench_sphere ( int triangles, float noise );
+float bench_uniform ( int *seed );
+
+const char *bench_pass_name[BENCH_PASS_NUM] = {
+  "edge_count",
+  "edge_null_delete",
+  "face_area_set",
+  "face_null_delete",
+  "vertex_normal_set",
+  "face_normal_ave",
+  "cor3_normal_set" };
+
+char bench_write_type[][8] = {
+  "3ds", "ase", "byu", "dxf", "gmod", "hrc", "iv", "ivc", "obj", "off",
+  "pov", "smf", "stla", "stlb", "tec", "tri", "trib", "txt", "ucd", "vla",
+  "wrl", "xgl" };
+
+BenchRow *bench_rows = NULL;
+int bench_row_max = 0;
+int bench_row_num = 0;
+
+//****************************************************************************80
+
+int main ( int argc, char *argv[] )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    MAIN is the main program for IVBENCH.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license.
+//
+//  Modified:
+//
+//    17 October 2026
+//
+//  Parameters:
+//
+//    Input, int ARGC, the number of command line arguments.
+//
+//    Input, char *ARGV[], the command line arguments.
+//
+//    Output, int MAIN, is 0 for success and 1 for failure.
+//
+{
+  char base_name[LINE_MAX_LEN];
+  char *csv_name;
+  char *dir_name;
+  long int bytes;
+  FILE *file;
+  char format[BENCH_FORMAT_MAX][8];
+  int format_num;
+  char in_name[LINE_MAX_LEN];
+  int i;
+  int iarg;
+  int iformat;
+  int ishape;
+  int isize;
+  int jformat;
+  char *json_name;
+  char out_name[LINE_MAX_LEN];
+  bool readable[BENCH_FORMAT_MAX];
+  BenchResult result;
+  long int rss_kb;
+  char shape[BENCH_SIZE_MAX][8];
+  int shape_num;
+  char size[BENCH_SIZE_MAX][8];
+  int size_num;
+  char sizes[LINE_MAX_LEN];
+  char shapes[LINE_MAX_LEN];
+  char formats[LINE_MAX_LEN];
+  double seconds;
+  int triangles;
+
+  ivcon_ctx = context_new ( );
+  ivcon_ctx->out.rdbuf ( NULL );
+
+  csv_name = NULL;
+  dir_name = ( char * ) "ivbench_data";
+  json_name = NULL;
+  strcpy ( formats, "all" );
+  strcpy ( shapes, "sphere,grid,scan" );
+  strcpy ( sizes, "1000,10000,100000" );
+//
+//  Get the options.
+//
+  for ( iarg = 1; iarg < argc; iarg = iarg + 2 )
+  {
+    if ( iarg + 1 == argc || LINE_MAX_LEN <= strlen ( argv[iarg+1] ) )
+    {
+      cout << "\n";
+      cout << "IVBENCH - Fatal error!\n";
+      cout << "  Option " << argv[iarg] << " has no value, or too long a one.\n";
+      return 1;
+    }
+    else if ( s_eqi ( argv[iarg], "-SIZES" ) )
+    {
+      strcpy ( sizes, argv[iarg+1] );
+    }
+    else if ( s_eqi ( argv[iarg], "-SHAPES" ) )
+    {
+      strcpy ( shapes, argv[iarg+1] );
+    }
+    else if ( s_eqi ( argv[iarg], "-FORMATS" ) )
+    {
+      strcpy ( formats, argv[iarg+1] );
+    }
+    else if ( s_eqi ( argv[iarg], "-DIR" ) )
+    {
+      dir_name = argv[iarg+1];
+    }
+    else if ( s_eqi ( argv[iarg], "-CSV" ) )
+    {
+      csv_name = argv[iarg+1];
+    }
+    else if ( s_eqi ( argv[iarg], "-JSON" ) )
+    {
+      json_name = argv[iarg+1];
+    }
+    else
+    {
+      cout << "\n";
+      cout << "IVBENCH - Fatal error!\n";
+      cout << "  Unknown option " << argv[iarg] << ".\n";
+      return 1;
+    }
+  }
+
+  size_num = bench_list ( sizes, size, BENCH_SIZE_MAX );
+  shape_num = bench_list ( shapes, shape, BENCH_SIZE_MAX );
+
+  if ( s_eqi ( formats, "ALL" ) )
+  {
+    format_num = sizeof ( bench_write_type ) / sizeof ( bench_write_type[0] );
+    for ( iformat = 0; iformat < format_num; iformat++ )
+    {
+      strcpy ( format[iformat], bench_write_type[iformat] );
+    }
+  }
+  else
+  {
+    format_num = bench_list ( formats, format, BENCH_FORMAT_MAX );
+  }
+
+  for ( ishape = 0; ishape < shape_num; ishape++ )
+  {
+    if ( !s_eqi ( shape[ishape], "SPHERE" ) &&
+         !s_eqi ( shape[ishape], "GRID" ) &&
+         !s_eqi ( shape[ishape], "SCAN" ) )
+    {
+      cout << "\n";
+      cout << "IVBENCH - Fatal error!\n";
+      cout << "  Unknown shape " << shape[ishape] << ".\n";
+      return 1;
+    }
+  }
+
+  if ( mkdir ( dir_name, 0777 ) != 0 && errno != EEXIST )
+  {
+    cout << "\n";
+    cout << "IVBENCH - Fatal error!\n";
+    cout << "  Could not make the directory " << dir_name << ".\n";
+    return 1;
+  }
+
+  cout << "\n";
+  cout << "  Shape     Triangles  Reader  Writer  Stage                   "
+       << "   Seconds        MB/s     Tri/s  Peak KB\n";
+  cout << "\n";
+  cout.flush ( );
+
+  for ( ishape = 0; ishape < shape_num; ishape++ )
+  {
+    for ( isize = 0; isize < size_num; isize++ )
+    {
+      triangles = atoi ( size[isize] );
+
+      if ( triangles < 1 )
+      {
+        continue;
+      }
+//
+//  Make the mesh, and write it as a binary STL file, from which the
+//  files in the other formats are made.
+//
+      bench_generate ( shape[ishape], triangles );
+      triangles = ivcon_ctx->mesh.face_num;
+
+      if ( LINE_MAX_LEN <= snprintf ( base_name, LINE_MAX_LEN,
+             "%s/%s_%d.stlb", dir_name, shape[ishape], triangles ) )
+      {
+        cout << "\n";
+        cout << "IVBENCH - Fatal error!\n";
+        cout << "  The directory name " << dir_name << " is too long.\n";
+        return 1;
+      }
+      strcpy ( ivcon_ctx->filein_name, "IVBENCH" );
+      strcpy ( ivcon_ctx->fileout_name, base_name );
+      data_write ( );
+      ivcon_ctx->mesh.clear ( );
+
+      for ( iformat = 0; iformat < format_num; iformat++ )
+      {
+        readable[iformat] = file_ext_readable ( format[iformat] );
+        if ( !readable[iformat] )
+        {
+          continue;
+        }
+        if ( LINE_MAX_LEN <= snprintf ( in_name, LINE_MAX_LEN, "%s/%s_%d.%s",
+               dir_name, shape[ishape], triangles, format[iformat] ) ||
+             !bench_run ( base_name, in_name, &result, &rss_kb ) )
+        {
+          readable[iformat] = false;
+        }
+      }
+//
+//  Time each reader, and the passes on the data it read.
+//
+      for ( iformat = 0; iformat < format_num; iformat++ )
+      {
+        if ( !file_ext_readable ( format[iformat] ) )
+        {
+          continue;
+        }
+        if ( LINE_MAX_LEN <= snprintf ( in_name, LINE_MAX_LEN, "%s/%s_%d.%s",
+               dir_name, shape[ishape], triangles, format[iformat] ) )
+        {
+          continue;
+        }
+        bytes = bench_size ( in_name );
+
+        if ( !readable[iformat] ||
+             !bench_run ( in_name, NULL, &result, &rss_kb ) )
+        {
+          bench_row ( shape[ishape], triangles, format[iformat],
+            ( char * ) "", "read", false, bytes, 0.0, 0 );
+          readable[iformat] = false;
+          continue;
+        }
+
+        seconds = 0.0;
+        for ( i = 0; i < STAGE_NUM; i++ )
+        {
+          seconds = seconds + result.seconds[i];
+        }
+        bench_row ( shape[ishape], triangles, format[iformat], ( char * ) "",
+          "read", true, bytes, seconds, rss_kb );
+
+        for ( i = 0; i < STAGE_NUM; i++ )
+        {
+          bench_row ( shape[ishape], triangles, format[iformat], ( char * ) "",
+            stage_name[i], true, 0, result.seconds[i], rss_kb );
+        }
+
+        for ( i = 0; i < BENCH_PASS_NUM; i++ )
+        {
+          bench_row ( shape[ishape], triangles, format[iformat], ( char * ) "",
+            bench_pass_name[i], true, 0, result.seconds[STAGE_NUM+1+i],
+            rss_kb );
+        }
+      }
+//
+//  Time each reader and writer pair.
+//
+      for ( iformat = 0; iformat < format_num; iformat++ )
+      {
+        if ( !readable[iformat] )
+        {
+          continue;
+        }
+        if ( LINE_MAX_LEN <= snprintf ( in_name, LINE_MAX_LEN, "%s/%s_%d.%s",
+               dir_name, shape[ishape], triangles, format[iformat] ) )
+        {
+          continue;
+        }
+
+        for ( jformat = 0; jformat < format_num; jformat++ )
+        {
+          if ( LINE_MAX_LEN <= snprintf ( out_name, LINE_MAX_LEN, "%s/out.%s",
+                 dir_name, format[jformat] ) )
+          {
+            continue;
+          }
+
+          bench_run ( in_name, out_name, &result, &rss_kb );
+
+          bytes = bench_size ( out_name );
+          remove ( out_name );
+
+          seconds = result.seconds[STAGE_NUM];
+          bench_row ( shape[ishape], triangles, format[iformat],
+            format[jformat], "write", result.ok, bytes, seconds, rss_kb );
+
+          for ( i = 0; i < STAGE_NUM; i++ )
+          {
+            seconds = seconds + result.seconds[i];
+          }
+          bench_row ( shape[ishape], triangles, format[iformat],
+            format[jformat], "convert", result.ok, bench_size ( in_name ),
+            seconds, rss_kb );
+        }
+      }
+    }
+  }
+//
+//  Write the reports.
+//
+  if ( csv_name != NULL )
+  {
+    file = fopen ( csv_name, "w" );
+    if ( file == NULL )
+    {
+      cout << "\n";
+      cout << "IVBENCH - Fatal error!\n";
+      cout << "  Could not open " << csv_name << ".\n";
+      return 1;
+    }
+    bench_report_csv ( file );
+    fclose ( file );
+  }
+
+  if ( json_name != NULL )
+  {
+    file = fopen ( json_name, "w" );
+    if ( file == NULL )
+    {
+      cout << "\n";
+      cout << "IVBENCH - Fatal error!\n";
+      cout << "  Could not open " << json_name << ".\n";
+      return 1;
+    }
+    bench_report_json ( file );
+    fclose ( file );
+  }
+
+  delete [] bench_rows;
+  context_delete ( ivcon_ctx );
+  ivcon_ctx = NULL;
+
+  return 0;
+}
+//****************************************************************************80
+
+void bench_generate ( char *shape, int triangles )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    BENCH_GENERATE makes a synthetic mesh.
+//
+//  Discussion:
+//
+//    The mesh is made in the current context, with a normal vector for
+//    each face.  Its number of triangles is near TRIANGLES.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license.
+//
+//  Modified:
+//
+//    17 October 2026
+//
+//  Parameters:
+//
+//    Input, char *SHAPE, "sphere", "grid" or "scan".
+//
+//    Input, int TRIANGLES, the number of triangles wanted.
+//
+{
+  float ax;
+  float ay;
+  float az;
+  float bx;
+  float by;
+  float bz;
+  int i;
+  int iface;
+  int node[3];
+  float norm;
+  float nx;
+  float ny;
+  float nz;
+
+  data_init ( );
+
+  if ( s_eqi ( shape, "GRID" ) )
+  {
+    bench_grid ( triangles );
+  }
+  else if ( s_eqi ( shape, "SCAN" ) )
+  {
+    bench_sphere ( triangles, 0.01 );
+  }
+  else
+  {
+    bench_sphere ( triangles, 0.0 );
+  }
+//
+//  Set the face normals.
+//
+  for ( iface = 0; iface < ivcon_ctx->mesh.face_num; iface++ )
+  {
+    for ( i = 0; i < 3; i++ )
+    {
+      node[i] = ivcon_ctx->mesh.vertex_node[ivcon_ctx->mesh.face_start[iface]+i];
+    }
+
+    ax = ivcon_ctx->mesh.cor3[0][node[1]] - ivcon_ctx->mesh.cor3[0][node[0]];
+    ay = ivcon_ctx->mesh.cor3[1][node[1]] - ivcon_ctx->mesh.cor3[1][node[0]];
+    az = ivcon_ctx->mesh.cor3[2][node[1]] - ivcon_ctx->mesh.cor3[2][node[0]];
+    bx = ivcon_ctx->mesh.cor3[0][node[2]] - ivcon_ctx->mesh.cor3[0][node[0]];
+    by = ivcon_ctx->mesh.cor3[1][node[2]] - ivcon_ctx->mesh.cor3[1][node[0]];
+    bz = ivcon_ctx->mesh.cor3[2][node[2]] - ivcon_ctx->mesh.cor3[2][node[0]];
+
+    nx = ay * bz - az * by;
+    ny = az * bx - ax * bz;
+    nz = ax * by - ay * bx;
+    norm = sqrt ( nx * nx + ny * ny + nz * nz );
+
+    if ( 0.0 < norm )
+    {
+      nx = nx / norm;
+      ny = ny / norm;
+      nz = nz / norm;
+    }
+
+    ivcon_ctx->mesh.face_normal[0][iface] = nx;
+    ivcon_ctx->mesh.face_normal[1][iface] = ny;
+    ivcon_ctx->mesh.face_normal[2][iface] = nz;
+  }
+
+  return;
+}
+//****************************************************************************80
+
+int bench_grid ( int triangles )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    BENCH_GRID makes a square height field.
+//
+//  Discussion:
+//
+//    The unit square is divided into M by M cells, each split into two
+//    triangles, and the nodes are raised by a gentle wave.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license.
+//
+//  Modified:
+//
+//    17 October 2026
+//
+//  Parameters:
+//
+//    Input, int TRIANGLES, the number of triangles wanted.
+//
+//    Output, int BENCH_GRID, the number of triangles made.
+//
+{
+  int i;
+  int iface;
+  int j;
+  int m;
+  int n00;
+  float x;
+  float y;
+
+  m = ( int ) ( 0.5 + sqrt ( 0.5 * triangles ) );
+  if ( m < 1 )
+  {
+    m = 1;
+  }
+
+  ivcon_ctx->mesh.cor3_grow ( ( m + 1 ) * ( m + 1 ) );
+  ivcon_ctx->mesh.face_grow ( 2 * m * m );
+
+  for ( j = 0; j <= m; j++ )
+  {
+    for ( i = 0; i <= m; i++ )
+    {
+      x = ( float ) i / ( float ) m;
+      y = ( float ) j / ( float ) m;
+      ivcon_ctx->mesh.cor3[0][ivcon_ctx->mesh.cor3_num] = x;
+      ivcon_ctx->mesh.cor3[1][ivcon_ctx->mesh.cor3_num] = y;
+      ivcon_ctx->mesh.cor3[2][ivcon_ctx->mesh.cor3_num] =
+        0.05 * sin ( 2.0 * PI * x ) * cos ( 2.0 * PI * y );
+      ivcon_ctx->mesh.cor3_num = ivcon_ctx->mesh.cor3_num + 1;
+    }
+  }
+
+  iface = 0;
+
+  for ( j = 0; j < m; j++ )
+  {
+    for ( i = 0; i < m; i++ )
+    {
+      n00 = j * ( m + 1 ) + i;
+
+      ivcon_ctx->mesh.vertex_node[ivcon_ctx->mesh.vertex_at ( iface, 0 )] = n00;
+      ivcon_ctx->mesh.vertex_node[ivcon_ctx->mesh.vertex_at ( iface, 1 )] = n00 + 1;
+      ivcon_ctx->mesh.vertex_node[ivcon_ctx->mesh.vertex_at ( iface, 2 )] = n00 + m + 2;
+      ivcon_ctx->mesh.face_order[iface] = 3;
+      iface = iface + 1;
+
+      ivcon_ctx->mesh.vertex_node[ivcon_ctx->mesh.vertex_at ( iface, 0 )] = n00;
+      ivcon_ctx->mesh.vertex_node[ivcon_ctx->mesh.vertex_at ( iface, 1 )] = n00 + m + 2;
+      ivcon_ctx->mesh.vertex_node[ivcon_ctx->mesh.vertex_at ( iface, 2 )] = n00 + m + 1;
+      ivcon_ctx->mesh.face_order[iface] = 3;
+      iface = iface + 1;
+    }
+  }
+
+  ivcon_ctx->mesh.face_num = iface;
+
+  return iface;
+}
+//****************************************************************************80
+
+int bench_list ( char *list, char item[][8], int item_max )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    BENCH_LIST splits a comma separated list.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license.
+//
+//  Modified:
+//
+//    17 October 2026
+//
+//  Parameters:
+//
+//    Input/output, char *LIST, the list.  The commas are overwritten.
+//
+//    Output, char ITEM[ITEM_MAX][8], the items.  Longer items are cut short.
+//
+//    Input, int ITEM_MAX, the maximum number of items.
+//
+//    Output, int BENCH_LIST, the number of items.
+//
+{
+  int item_num;
+  char *token;
+
+  item_num = 0;
+
+  for ( token = strtok ( list, "," ); token != NULL && item_num < item_max;
+        token = strtok ( NULL, "," ) )
+  {
+    strncpy ( item[item_num], token, 7 );
+    item[item_num][7] = '\0';
+    item_num = item_num + 1;
+  }
+
+  return item_num;
+}
+//****************************************************************************80
+
+void bench_report_csv ( FILE *file )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    BENCH_REPORT_CSV writes the results as comma separated values.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license.
+//
+//  Modified:
+//
+//    17 October 2026
+//
+//  Parameters:
+//
+//    Input, FILE *FILE, the file.
+//
+{
+  int i;
+  BenchRow *row;
+
+  fprintf ( file, "shape,triangles,reader,writer,stage,ok,bytes,seconds,"
+    "mb_per_s,triangles_per_s,peak_rss_kb\n" );
+
+  for ( i = 0; i < bench_row_num; i++ )
+  {
+    row = bench_rows + i;
+
+    fprintf ( file, "%s,%d,%s,%s,\"%s\",%d,%ld,%.6f,", row->shape,
+      row->triangles, row->reader, row->writer, row->stage, row->ok ? 1 : 0,
+      row->bytes, row->seconds );
+
+    if ( 0 < row->bytes && 0.0 < row->seconds )
+    {
+      fprintf ( file, "%.3f", row->bytes / row->seconds / 1.0E+06 );
+    }
+    fprintf ( file, "," );
+
+    if ( 0.0 < row->seconds )
+    {
+      fprintf ( file, "%.0f", row->triangles / row->seconds );
+    }
+    fprintf ( file, ",%ld\n", row->rss_kb );
+  }
+
+  return;
+}
+//****************************************************************************80
+
+void bench_report_json ( FILE *file )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    BENCH_REPORT_JSON writes the results as a JSON array.
+//
+//  Discussion:
+//
+//    MB_PER_S and TRIANGLES_PER_S are null where they cannot be computed.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license.
+//
+//  Modified:
+//
+//    17 October 2026
+//
+//  Parameters:
+//
+//    Input, FILE *FILE, the file.
+//
+{
+  int i;
+  BenchRow *row;
+
+  fprintf ( file, "[\n" );
+
+  for ( i = 0; i < bench_row_num; i++ )
+  {
+    row = bench_rows + i;
+
+    fprintf ( file, "  {\"shape\": \"%s\", \"triangles\": %d, "
+      "\"reader\": \"%s\", \"writer\": \"%s\", \"stage\": \"%s\", "
+      "\"ok\": %s, \"bytes\": %ld, \"seconds\": %.6f, \"mb_per_s\": ",
+      row->shape, row->triangles, row->reader, row->writer, row->stage,
+      row->ok ? "true" : "false", row->bytes, row->seconds );
+
+    if ( 0 < row->bytes && 0.0 < row->seconds )
+    {
+      fprintf ( file, "%.3f", row->bytes / row->seconds / 1.0E+06 );
+    }
+    else
+    {
+      fprintf ( file, "null" );
+    }
+
+    fprintf ( file, ", \"triangles_per_s\": " );
+
+    if ( 0.0 < row->seconds )
+    {
+      fprintf ( file, "%.0f", row->triangles / row->seconds );
+    }
+    else
+    {
+      fprintf ( file, "null" );
+    }
+
+    fprintf ( file, ", \"peak_rss_kb\": %ld}%s\n", row->rss_kb,
+      i < bench_row_num - 1 ? "," : "" );
+  }
+
+  fprintf ( file, "]\n" );
+
+  return;
+}
+//****************************************************************************80
+
+void bench_row ( char *shape, int triangles, char *reader, char *writer,
+  const char *stage, bool ok, long int bytes, double seconds,
+  long int rss_kb )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    BENCH_ROW records one result, and prints it.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license.
+//
+//  Modified:
+//
+//    17 October 2026
+//
+//  Parameters:
+//
+//    Input, char *SHAPE, the mesh.
+//
+//    Input, int TRIANGLES, the number of triangles in the mesh.
+//
+//    Input, char *READER, char *WRITER, the formats read and written.
+//    WRITER is empty for the reader results.
+//
+//    Input, const char *STAGE, the name of what was timed.
+//
+//    Input, bool OK, is TRUE if the work succeeded.
+//
+//    Input, long int BYTES, the size of the file read or written, or 0.
+//
+//    Input, double SECONDS, the time taken.
+//
+//    Input, long int RSS_KB, the peak memory of the worker, in kilobytes.
+//
+{
+  BenchRow *row;
+  BenchRow *row_temp;
+
+  if ( bench_row_num == bench_row_max )
+  {
+    bench_row_max = i4_max ( 256, 2 * bench_row_max );
+    row_temp = new BenchRow[bench_row_max];
+    if ( 0 < bench_row_num )
+    {
+      memcpy ( row_temp, bench_rows, bench_row_num * sizeof ( BenchRow ) );
+    }
+    delete [] bench_rows;
+    bench_rows = row_temp;
+  }
+
+  row = bench_rows + bench_row_num;
+  bench_row_num = bench_row_num + 1;
+
+  strncpy ( row->shape, shape, 7 );
+  row->shape[7] = '\0';
+  row->triangles = triangles;
+  strncpy ( row->reader, reader, 7 );
+  row->reader[7] = '\0';
+  strncpy ( row->writer, writer, 7 );
+  row->writer[7] = '\0';
+  strncpy ( row->stage, stage, 31 );
+  row->stage[31] = '\0';
+  row->ok = ok;
+  row->bytes = bytes;
+  row->seconds = seconds;
+  row->rss_kb = rss_kb;
+
+  cout << "  " << setw(6) << left << row->shape << right
+       << setw(12) << row->triangles << "  "
+       << setw(6) << left << row->reader << "  "
+       << setw(6) << row->writer << "  "
+       << setw(24) << row->stage << right;
+
+  if ( !ok )
+  {
+    cout << "      failed\n";
+    cout.flush ( );
+    return;
+  }
+
+  cout << setw(10) << fixed << setprecision(6) << seconds;
+
+  if ( 0 < bytes && 0.0 < seconds )
+  {
+    cout << setw(12) << setprecision(1) << bytes / seconds / 1.0E+06;
+  }
+  else
+  {
+    cout << setw(12) << "";
+  }
+
+  if ( 0.0 < seconds )
+  {
+    cout << setw(10) << setprecision(0) << triangles / seconds;
+  }
+  else
+  {
+    cout << setw(10) << "";
+  }
+
+  cout << setw(9) << rss_kb << "\n";
+  cout.unsetf ( ios::floatfield );
+  cout.flush ( );
+
+  return;
+}
+//****************************************************************************80
+
+bool bench_run ( char *in_name, char *out_name, BenchResult *result,
+  long int *rss_kb )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    BENCH_RUN reads a file, and writes one, in a worker process.
+//
+//  Discussion:
+//
+//    The worker reads IN_NAME with DATA_READ.  If OUT_NAME is given, it
+//    writes it with DATA_WRITE; otherwise it runs each of the passes in
+//    turn on the data.  The times are sent back through a pipe.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license.
+//
+//  Modified:
+//
+//    17 October 2026
+//
+//  Parameters:
+//
+//    Input, char *IN_NAME, the file to read.
+//
+//    Input, char *OUT_NAME, the file to write, or NULL.
+//
+//    Output, BenchResult *RESULT, the times.
+//
+//    Output, long int *RSS_KB, the peak memory of the worker, in kilobytes.
+//
+//    Output, bool BENCH_RUN, is TRUE if the worker succeeded.
+//
+{
+  ssize_t got;
+  int i;
+  pid_t pid;
+  int pipe_fd[2];
+  int status;
+  double time_start;
+  struct rusage usage;
+
+  result->ok = false;
+  for ( i = 0; i < BENCH_TIME_NUM; i++ )
+  {
+    result->seconds[i] = 0.0;
+  }
+  *rss_kb = 0;
+
+  if ( pipe ( pipe_fd ) != 0 )
+  {
+    return false;
+  }
+
+  pid = fork ( );
+
+  if ( pid < 0 )
+  {
+    close ( pipe_fd[0] );
+    close ( pipe_fd[1] );
+    return false;
+  }
+//
+//  The worker.
+//
+  if ( pid == 0 )
+  {
+    close ( pipe_fd[0] );
+
+    if ( freopen ( "/dev/null", "w", stdout ) == NULL )
+    {
+      _exit ( 1 );
+    }
+
+    data_init ( );
+    strcpy ( ivcon_ctx->filein_name, in_name );
+
+    if ( !data_read ( ) )
+    {
+      _exit ( 1 );
+    }
+
+    for ( i = 0; i < STAGE_NUM; i++ )
+    {
+      result->seconds[i] = ivcon_ctx->stage_time[i+1] - ivcon_ctx->stage_time[i];
+    }
+
+    if ( out_name != NULL )
+    {
+      strcpy ( ivcon_ctx->fileout_name, out_name );
+      time_start = wall_time ( );
+      if ( data_write ( ) != 0 )
+      {
+        _exit ( 1 );
+      }
+      result->seconds[STAGE_NUM] = wall_time ( ) - time_start;
+    }
+    else
+    {
+      for ( i = 0; i < BENCH_PASS_NUM; i++ )
+      {
+        time_start = wall_time ( );
+        if ( i == 0 )
+        {
+          edge_count ( );
+        }
+        else if ( i == 1 )
+        {
+          edge_null_delete ( );
+        }
+        else if ( i == 2 )
+        {
+          face_area_set ( );
+        }
+        else if ( i == 3 )
+        {
+          face_null_delete ( );
+        }
+        else if ( i == 4 )
+        {
+          vertex_normal_set ( );
+        }
+        else if ( i == 5 )
+        {
+          face_normal_ave ( );
+        }
+        else
+        {
+          cor3_normal_set ( );
+        }
+        result->seconds[STAGE_NUM+1+i] = wall_time ( ) - time_start;
+      }
+    }
+
+    result->ok = true;
+
+    if ( write ( pipe_fd[1], result, sizeof ( BenchResult ) ) !=
+         ( ssize_t ) sizeof ( BenchResult ) )
+    {
+      _exit ( 1 );
+    }
+    _exit ( 0 );
+  }
+//
+//  The parent.
+//
+  close ( pipe_fd[1] );
+
+  got = read ( pipe_fd[0], result, sizeof ( BenchResult ) );
+
+  close ( pipe_fd[0] );
+
+  if ( wait4 ( pid, &status, 0, &usage ) == pid )
+  {
+    *rss_kb = usage.ru_maxrss;
+  }
+
+  if ( got != ( ssize_t ) sizeof ( BenchResult ) ||
+       !WIFEXITED ( status ) || WEXITSTATUS ( status ) != 0 )
+  {
+    result->ok = false;
+  }
+
+  return result->ok;
+}
+//****************************************************************************80
+
+long int bench_size ( char *file_name )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    BENCH_SIZE returns the size of a file.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license.
+//
+//  Modified:
+//
+//    17 October 2026
+//
+//  Parameters:
+//
+//    Input, char *FILE_NAME, the name of the file.
+//
+//    Output, long int BENCH_SIZE, the size in bytes, or 0 if the file
+//    does not exist.
+//
+{
+  struct stat info;
+
+  if ( stat ( file_name, &info ) != 0 )
+  {
+    return 0;
+  }
+
+  return ( long int ) info.st_size;
+}
+//****************************************************************************80
+
+int bench_sphere ( int triangles, float noise )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    BENCH_SPHERE makes a sphere of latitude and longitude bands.
+//
+//  Discussion:
+//
+//    There are K bands of latitude and 2 * K of longitude, giving
+//    4 * K * ( K - 1 ) triangles.  Each node other than the poles is moved
+//    out or in by a random fraction of the radius up to NOISE, always in
+//    the same way for the same K.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license.
+//
+//  Modified:
+//
+//    17 October 2026
+//
+//  Parameters:
+//
+//    Input, int TRIANGLES, the number of triangles wanted.
+//
+//    Input, float NOISE, the largest change in the radius.
+//
+//    Output, int BENCH_SPHERE, the number of triangles made.
+//
+{
+  int i;
+  int iface;
+  int j;
+  int k;
+  int n0;
+  int n1;
+  int nlon;
+  float phi;
+  float r;
+  int seed;
+  int south;
+  float theta;
+
+  k = 1 + ( int ) ( 0.5 + 0.5 * sqrt ( ( double ) triangles ) );
+  if ( k < 2 )
+  {
+    k = 2;
+  }
+  nlon = 2 * k;
+  south = 1 + ( k - 1 ) * nlon;
+  seed = 123456789;
+
+  ivcon_ctx->mesh.cor3_grow ( south + 1 );
+  ivcon_ctx->mesh.face_grow ( 2 * nlon * ( k - 1 ) );
+//
+//  The north pole, the rings, and the south pole.
+//
+  ivcon_ctx->mesh.cor3[0][0] = 0.0;
+  ivcon_ctx->mesh.cor3[1][0] = 0.0;
+  ivcon_ctx->mesh.cor3[2][0] = 1.0;
+
+  for ( i = 1; i < k; i++ )
+  {
+    phi = PI * ( float ) i / ( float ) k;
+
+    for ( j = 0; j < nlon; j++ )
+    {
+      theta = 2.0 * PI * ( float ) j / ( float ) nlon;
+      r = 1.0 + noise * ( 2.0 * bench_uniform ( &seed ) - 1.0 );
+      n0 = 1 + ( i - 1 ) * nlon + j;
+      ivcon_ctx->mesh.cor3[0][n0] = r * sin ( phi ) * cos ( theta );
+      ivcon_ctx->mesh.cor3[1][n0] = r * sin ( phi ) * sin ( theta );
+      ivcon_ctx->mesh.cor3[2][n0] = r * cos ( phi );
+    }
+  }
+
+  ivcon_ctx->mesh.cor3[0][south] = 0.0;
+  ivcon_ctx->mesh.cor3[1][south] = 0.0;
+  ivcon_ctx->mesh.cor3[2][south] = -1.0;
+  ivcon_ctx->mesh.cor3_num = south + 1;
+//
+//  The faces, counterclockwise seen from outside.
+//
+  iface = 0;
+
+  for ( j = 0; j < nlon; j++ )
+  {
+    ivcon_ctx->mesh.vertex_node[ivcon_ctx->mesh.vertex_at ( iface, 0 )] = 0;
+    ivcon_ctx->mesh.vertex_node[ivcon_ctx->mesh.vertex_at ( iface, 1 )] = 1 + j;
+    ivcon_ctx->mesh.vertex_node[ivcon_ctx->mesh.vertex_at ( iface, 2 )] =
+      1 + ( j + 1 ) % nlon;
+    ivcon_ctx->mesh.face_order[iface] = 3;
+    iface = iface + 1;
+  }
+
+  for ( i = 1; i < k - 1; i++ )
+  {
+    for ( j = 0; j < nlon; j++ )
+    {
+      n0 = 1 + ( i - 1 ) * nlon;
+      n1 = n0 + nlon;
+
+      ivcon_ctx->mesh.vertex_node[ivcon_ctx->mesh.vertex_at ( iface, 0 )] = n0 + j;
+      ivcon_ctx->mesh.vertex_node[ivcon_ctx->mesh.vertex_at ( iface, 1 )] = n1 + j;
+      ivcon_ctx->mesh.vertex_node[ivcon_ctx->mesh.vertex_at ( iface, 2 )] =
+        n1 + ( j + 1 ) % nlon;
+      ivcon_ctx->mesh.face_order[iface] = 3;
+      iface = iface + 1;
+
+      ivcon_ctx->mesh.vertex_node[ivcon_ctx->mesh.vertex_at ( iface, 0 )] = n0 + j;
+      ivcon_ctx->mesh.vertex_node[ivcon_ctx->mesh.vertex_at ( iface, 1 )] =
+        n1 + ( j + 1 ) % nlon;
+      ivcon_ctx->mesh.vertex_node[ivcon_ctx->mesh.vertex_at ( iface, 2 )] =
+        n0 + ( j + 1 ) % nlon;
+      ivcon_ctx->mesh.face_order[iface] = 3;
+      iface = iface + 1;
+    }
+  }
+
+  n0 = 1 + ( k - 2 ) * nlon;
+
+  for ( j = 0; j < nlon; j++ )
+  {
+    ivcon_ctx->mesh.vertex_node[ivcon_ctx->mesh.vertex_at ( iface, 0 )] = south;
+    ivcon_ctx->mesh.vertex_node[ivcon_ctx->mesh.vertex_at ( iface, 1 )] =
+      n0 + ( j + 1 ) % nlon;
+    ivcon_ctx->mesh.vertex_node[ivcon_ctx->mesh.vertex_at ( iface, 2 )] = n0 + j;
+    ivcon_ctx->mesh.face_order[iface] = 3;
+    iface = iface + 1;
+  }
+
+  ivcon_ctx->mesh.face_num = iface;
+
+  return iface;
+}
+//****************************************************************************80
+
+float bench_uniform ( int *seed )
+
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    BENCH_UNIFORM returns a pseudorandom number between 0 and 1.
+//
+//  Discussion:
+//
+//    This is the Park and Miller minimal standard generator, so that the
+//    meshes are the same on every system.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license.
+//
+//  Modified:
+//
+//    17 October 2026
+//
+//  Parameters:
+//
+//    Input/output, int *SEED, the seed, which should not be 0.
+//
+//    Output, float BENCH_UNIFORM, a value strictly between 0 and 1.
+//
+{
+  int k;
+
+  k = *seed / 127773;
+
+  *seed = 16807 * ( *seed - k * 127773 ) - k * 2836;
+
+  if ( *seed < 0 )
+  {
+    *seed = *seed + 2147483647;
+  }
+
+  return ( float ) ( *seed ) * 4.656612875E-10;
+}
@@ -0,0 +1,45 @@
+//****************************************************************************80
+//
+//  Purpose:
+//
+//    IVCON.H declares the library interface of IVCON.
+//
+//  Discussion:
+//
+//    A conversion is carried out in a CONVERSIONCONTEXT, which holds the
+//    model data and all the options.  Each context may be used for one
+//    conversion at a time, and for any number of conversions in turn.
+//    Conversions in different contexts may run at the same time, in
+//    different threads.
+//
+//      ConversionContext *context;
+//
+//      context = context_new ( );
+//      context_option ( context, "-rn" );
+//      convert ( context, "part.obj", "part.wrl" );
+//      context_delete ( context );
+//
+//    To build the library instead of the program, compile IVCON.CPP with
+//    IVCON_LIBRARY defined, which leaves out MAIN, and gives everything
+//    but the functions declared here internal linkage.
+//
+//  Licensing:
+//
+//    This code is distributed under the GNU LGPL license.
+//
+//  Modified:
+//
+//    17 October 2026
+//
+# ifndef IVCON_H
+# define IVCON_H
+
+class ConversionContext;
+
+void context_delete ( ConversionContext *context );
+ConversionContext *context_new ( );
+bool context_option ( ConversionContext *context, const char *option );
+int convert ( ConversionContext *context, const char *filein_name,
+  const char *fileout_name );
+
+# endif